@@ -0,0 +1,113 @@
+// : CompilerContext        .
+//  operator new  .  ,    :
+//   g++ -std=c++14 -O2 -pthread AllocationTest.cpp -o AllocationTest
+//   cl /std:c++14 /O2 /EHsc AllocationTest.cpp
+//   0 -  .
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include "CompilerContext.h"
+
+static std::atomic<size_t> allocations(0);
+
+void* operator new(std::size_t size)
+{
+    ++allocations;
+    void* p = std::malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    operator delete(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    operator delete(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    operator delete(p);
+}
+
+//     :   
+static std::string identifier(size_t number)
+{
+    std::string name = "f";
+    do
+    {
+        name += static_cast<char>('a' + number % 26);
+        number /= 26;
+    } while (number > 0);
+    return name;
+}
+
+static std::string program(size_t functions)
+{
+    std::string source;
+    for (size_t i = 0; i < functions; ++i)
+    {
+        source += "int " + identifier(i) + "() {\n";
+        source += "    int a, b = 4;\n";
+        source += "    float c = itof(1.5) + 2;\n";
+        source += "    return a;\n}\n";
+    }
+    return source;
+}
+
+// ,  compile()     
+static bool check(const char* what, size_t functions, size_t threads)
+{
+    std::string source = program(functions);
+    std::unique_ptr<CompilerContext> context(new CompilerContext(threads));
+
+    const int WARM_UP = 3;
+    const int RUNS = 100;
+    for (int run = 0; run < WARM_UP; ++run)
+    {
+        if (!context->compile(source).ok())
+        {
+            std::cout << what << ":  \n";
+            return false;
+        }
+    }
+
+    size_t before = allocations;
+    for (int run = 0; run < RUNS; ++run)
+    {
+        context->compile(source);
+    }
+    size_t count = allocations - before;
+
+    std::cout << what << ":  " << functions << ",  " << threads
+        << ",    " << RUNS << " : " << count << '\n';
+    return count == 0;
+}
+
+int main()
+{
+    //   FUNCTIONS_PER_THREAD * 2,      
+    bool ok = check(" ", 1, 0);
+    ok = check(" ,    ", 200, 0) && ok;
+    ok = check(" , 2 ", 40, 2) && ok;
+    ok = check(" , 8 ", 200, 8) && ok;
+
+    std::cout << (ok ? "OK" : "") << '\n';
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,139 @@
+#pragma once
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "BinaryFormat.h"
+#include "FileIO.h"
+#include "HashTable.h"
+#include "SyntaxAnalyzer.h"
+#include "Token.h"
+
+//  ,         (. BinaryFormat.h)
+class BinaryExporter
+{
+public:
+    BinaryExporter(TokenList tokens, const HashTable& hashTable,
+        const ParseTreeNode* root)
+        : tokens(tokens), hashTable(hashTable), root(root)
+    {
+    }
+
+    bool write(const std::string& filename)
+    {
+        build();
+
+        uint32_t tokensOffset = HEADER_SIZE;
+        uint32_t symbolsOffset = tokensOffset + static_cast<uint32_t>(tokenTable.size());
+        uint32_t nodesOffset = symbolsOffset + static_cast<uint32_t>(symbolTable.size());
+        uint32_t fileSize = stringsOffset + static_cast<uint32_t>(strings.size());
+
+        unsigned char header[HEADER_SIZE];
+        writeU32(header + 4 * H_MAGIC, BINARY_MAGIC);
+        writeU32(header + 4 * H_VERSION, BINARY_VERSION);
+        writeU32(header + 4 * H_FILE_SIZE, fileSize);
+        writeU32(header + 4 * H_STRINGS_OFFSET, stringsOffset);
+        writeU32(header + 4 * H_STRINGS_SIZE, static_cast<uint32_t>(strings.size()));
+        writeU32(header + 4 * H_TOKENS_OFFSET, tokensOffset);
+        writeU32(header + 4 * H_TOKEN_COUNT, static_cast<uint32_t>(tokens.size()));
+        writeU32(header + 4 * H_SYMBOLS_OFFSET, symbolsOffset);
+        writeU32(header + 4 * H_SYMBOL_COUNT, static_cast<uint32_t>(hashTable.size()));
+        writeU32(header + 4 * H_NODES_OFFSET, nodesOffset);
+        writeU32(header + 4 * H_NODE_COUNT, nodeCount);
+        writeU32(header + 4 * H_ROOT, nodeCount > 0 ? 0 : NO_NODE);
+
+        return writeBuffers(filename, {
+            { header, sizeof(header) },
+            { tokenTable.data(), tokenTable.size() },
+            { symbolTable.data(), symbolTable.size() },
+            { nodeTable.data(), nodeTable.size() },
+            { strings.data(), strings.size() }
+        });
+    }
+
+private:
+    TokenList tokens;
+    const HashTable& hashTable;
+    const ParseTreeNode* root;
+
+    std::vector<char> strings; //  
+    std::unordered_map<std::string, uint32_t> stringIndex; //  ->    
+    std::vector<unsigned char> tokenTable;
+    std::vector<unsigned char> symbolTable;
+    std::vector<unsigned char> nodeTable;
+    uint32_t stringsOffset = 0;
+    uint32_t nodeCount = 0;
+
+    //      (    )
+    uint32_t intern(const std::string& value)
+    {
+        auto it = stringIndex.find(value);
+        if (it != stringIndex.end())
+        {
+            return it->second;
+        }
+        uint32_t offset = static_cast<uint32_t>(strings.size());
+        strings.insert(strings.end(), value.begin(), value.end());
+        strings.push_back('\0');
+        stringIndex.emplace(value, offset);
+        return offset;
+    }
+
+    void build()
+    {
+        //     ,      
+        std::vector<const ParseTreeNode*> order;
+        if (root)
+        {
+            order.push_back(root);
+            for (size_t i = 0; i < order.size(); ++i)
+            {
+                for (const ParseTreeNode* child : order[i]->children)
+                {
+                    order.push_back(child);
+                }
+            }
+        }
+        nodeCount = static_cast<uint32_t>(order.size());
+
+        //        
+        std::vector<uint32_t> tokenStrings, symbolStrings, nodeStrings;
+        for (const auto& token : tokens) tokenStrings.push_back(intern(token.first.value));
+        for (int i = 0; i < hashTable.size(); ++i) symbolStrings.push_back(intern(hashTable.at(i)->lexeme));
+        for (const ParseTreeNode* node : order) nodeStrings.push_back(intern(node->value));
+
+        stringsOffset = HEADER_SIZE + static_cast<uint32_t>(tokens.size()) * TOKEN_RECORD_SIZE
+            + static_cast<uint32_t>(hashTable.size()) * SYMBOL_RECORD_SIZE
+            + nodeCount * NODE_RECORD_SIZE;
+
+        tokenTable.reserve(tokens.size() * TOKEN_RECORD_SIZE);
+        for (size_t i = 0; i < tokens.size(); ++i)
+        {
+            appendU32(tokenTable, static_cast<uint32_t>(tokens[i].first.type));
+            appendU32(tokenTable, stringsOffset + tokenStrings[i]);
+            appendU32(tokenTable, static_cast<uint32_t>(tokens[i].first.value.size()));
+            appendU32(tokenTable, static_cast<uint32_t>(tokens[i].second));
+        }
+
+        symbolTable.reserve(hashTable.size() * SYMBOL_RECORD_SIZE);
+        for (int i = 0; i < hashTable.size(); ++i)
+        {
+            const OneToken* symbol = hashTable.at(i);
+            appendU32(symbolTable, static_cast<uint32_t>(symbol->type));
+            appendU32(symbolTable, stringsOffset + symbolStrings[i]);
+            appendU32(symbolTable, static_cast<uint32_t>(symbol->lexeme.size()));
+            appendU32(symbolTable, static_cast<uint32_t>(hashTable.hash(symbol->lexeme)));
+        }
+
+        nodeTable.reserve(order.size() * NODE_RECORD_SIZE);
+        uint32_t nextChild = 1; //      
+        for (size_t i = 0; i < order.size(); ++i)
+        {
+            uint32_t childCount = static_cast<uint32_t>(order[i]->children.size());
+            appendU32(nodeTable, stringsOffset + nodeStrings[i]);
+            appendU32(nodeTable, static_cast<uint32_t>(order[i]->value.size()));
+            appendU32(nodeTable, childCount > 0 ? nextChild : NO_NODE);
+            appendU32(nodeTable, childCount);
+            nextChild += childCount;
+        }
+    }
+};
\ No newline at end of file
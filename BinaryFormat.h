@@ -0,0 +1,59 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+//        .
+//   - uint32 little-endian,    -    .
+//
+//  (HEADER_SIZE ):
+//   magic, version,  ,
+//       ,
+//      ,
+//       (-   ),
+//      ,  
+// :  ,  ,  , 
+// : ,  ,  , 
+// :    ,  ,   ,  
+//      (   ),  -  0.
+//      .
+
+const uint32_t BINARY_MAGIC = 0x54534143; // "CAST"
+const uint32_t BINARY_VERSION = 1;
+const uint32_t NO_NODE = 0xFFFFFFFF;
+
+const uint32_t HEADER_FIELDS = 12;
+const uint32_t HEADER_SIZE = HEADER_FIELDS * 4;
+const uint32_t TOKEN_RECORD_SIZE = 16;
+const uint32_t SYMBOL_RECORD_SIZE = 16;
+const uint32_t NODE_RECORD_SIZE = 16;
+
+//   
+enum HeaderField
+{
+    H_MAGIC, H_VERSION, H_FILE_SIZE,
+    H_STRINGS_OFFSET, H_STRINGS_SIZE,
+    H_TOKENS_OFFSET, H_TOKEN_COUNT,
+    H_SYMBOLS_OFFSET, H_SYMBOL_COUNT,
+    H_NODES_OFFSET, H_NODE_COUNT, H_ROOT
+};
+
+//  uint32  little-endian     
+inline uint32_t readU32(const unsigned char* p)
+{
+    return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+}
+
+inline void writeU32(unsigned char* p, uint32_t value)
+{
+    p[0] = static_cast<unsigned char>(value);
+    p[1] = static_cast<unsigned char>(value >> 8);
+    p[2] = static_cast<unsigned char>(value >> 16);
+    p[3] = static_cast<unsigned char>(value >> 24);
+}
+
+inline void appendU32(std::vector<unsigned char>& out, uint32_t value)
+{
+    size_t at = out.size();
+    out.resize(at + 4);
+    writeU32(&out[at], value);
+}
\ No newline at end of file
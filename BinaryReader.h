@@ -0,0 +1,197 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "BinaryFormat.h"
+#include "HashTable.h"
+#include "Token.h"
+
+//   .         .
+struct TokenView
+{
+    TokenType type;
+    const char* lexeme;
+    uint32_t length;
+    uint32_t line;
+};
+
+struct SymbolView
+{
+    TokenType type;
+    const char* lexeme;
+    uint32_t length;
+    uint32_t hash;
+};
+
+struct NodeView
+{
+    const char* value;
+    uint32_t length;
+    uint32_t firstChild; // NO_NODE,   
+    uint32_t childCount;
+};
+
+//         :     
+class BinaryReader
+{
+public:
+    BinaryReader(const unsigned char* data, size_t size)
+        : data(data), length(size)
+    {
+        valid = check();
+    }
+
+    bool isValid() const { return valid; }
+
+    uint32_t tokenCount() const { return field(H_TOKEN_COUNT); }
+    uint32_t symbolCount() const { return field(H_SYMBOL_COUNT); }
+    uint32_t nodeCount() const { return field(H_NODE_COUNT); }
+    uint32_t rootIndex() const { return field(H_ROOT); }
+
+    TokenView token(uint32_t i) const
+    {
+        const unsigned char* p = data + field(H_TOKENS_OFFSET) + i * TOKEN_RECORD_SIZE;
+        return { static_cast<TokenType>(readU32(p)), text(readU32(p + 4)), readU32(p + 8), readU32(p + 12) };
+    }
+
+    SymbolView symbol(uint32_t i) const
+    {
+        const unsigned char* p = data + field(H_SYMBOLS_OFFSET) + i * SYMBOL_RECORD_SIZE;
+        return { static_cast<TokenType>(readU32(p)), text(readU32(p + 4)), readU32(p + 8), readU32(p + 12) };
+    }
+
+    NodeView node(uint32_t i) const
+    {
+        const unsigned char* p = data + field(H_NODES_OFFSET) + i * NODE_RECORD_SIZE;
+        return { text(readU32(p)), readU32(p + 4), readU32(p + 8), readU32(p + 12) };
+    }
+
+    //     output.txt ( ,   )
+    void writeText(std::ostream& out) const
+    {
+        out << "BEGIN" << '\n';
+        out << '\n';
+        for (uint32_t i = 0; i < symbolCount(); ++i)
+        {
+            SymbolView s = symbol(i);
+            out << HashTable::tokenTypeToString(s.type) << " | ";
+            out.write(s.lexeme, s.length);
+            out << "  |  " << s.hash << '\n';
+        }
+        out << '\n';
+        out << "END" << '\n';
+        out << '\n';
+        out << '\n';
+
+        if (rootIndex() != NO_NODE)
+        {
+            writeTree(out);
+        }
+    }
+
+    //     :       
+    static const uint32_t MAX_TREE_DEPTH = 10000;
+
+private:
+    const unsigned char* data;
+    size_t length;
+    bool valid = false;
+
+    uint32_t field(HeaderField f) const
+    {
+        return readU32(data + 4 * f);
+    }
+
+    const char* text(uint32_t offset) const
+    {
+        return reinterpret_cast<const char*>(data + offset);
+    }
+
+    //  [offset, offset + count * recordSize)    
+    bool inside(uint32_t offset, uint32_t count, uint32_t recordSize) const
+    {
+        return offset <= length && uint64_t(count) * recordSize <= length - offset;
+    }
+
+    bool check() const
+    {
+        if (data == nullptr || length < HEADER_SIZE) return false;
+        if (field(H_MAGIC) != BINARY_MAGIC || field(H_VERSION) != BINARY_VERSION) return false;
+        if (field(H_FILE_SIZE) != length) return false;
+        if (!inside(field(H_STRINGS_OFFSET), field(H_STRINGS_SIZE), 1)
+            || !inside(field(H_TOKENS_OFFSET), tokenCount(), TOKEN_RECORD_SIZE)
+            || !inside(field(H_SYMBOLS_OFFSET), symbolCount(), SYMBOL_RECORD_SIZE)
+            || !inside(field(H_NODES_OFFSET), nodeCount(), NODE_RECORD_SIZE)
+            || rootIndex() != (nodeCount() > 0 ? 0 : NO_NODE))
+        {
+            return false;
+        }
+
+        //     :        
+        for (uint32_t i = 0; i < tokenCount(); ++i)
+        {
+            TokenView t = token(i);
+            if (!isString(t.lexeme, t.length)) return false;
+        }
+        for (uint32_t i = 0; i < symbolCount(); ++i)
+        {
+            SymbolView s = symbol(i);
+            if (!isString(s.lexeme, s.length)) return false;
+        }
+
+        //    :        .
+        //    ,  ,   ,    -  
+        uint64_t nextChild = 1;
+        uint64_t levelEnd = 1; //   
+        uint32_t depth = 0;
+        for (uint32_t i = 0; i < nodeCount(); ++i)
+        {
+            NodeView n = node(i);
+            if (!isString(n.value, n.length)) return false;
+            if (i == levelEnd)
+            {
+                if (nextChild == levelEnd || ++depth > MAX_TREE_DEPTH) return false;
+                levelEnd = nextChild;
+            }
+            if (n.childCount == 0) continue;
+            if (n.firstChild != nextChild) return false;
+            nextChild += n.childCount;
+            if (nextChild > nodeCount()) return false;
+        }
+        return nodeCount() == 0 || nextChild == nodeCount();
+    }
+
+    //  [value, value + length)       
+    bool isString(const char* value, uint32_t stringLength) const
+    {
+        uint64_t offset = reinterpret_cast<const unsigned char*>(value) - data;
+        uint64_t begin = field(H_STRINGS_OFFSET);
+        uint64_t end = begin + field(H_STRINGS_SIZE);
+        return offset >= begin && offset + stringLength < end && value[stringLength] == '\0';
+    }
+
+    //      ,   
+    void writeTree(std::ostream& out) const
+    {
+        std::vector<std::pair<uint32_t, uint32_t>> stack; // , 
+        stack.emplace_back(rootIndex(), 0);
+        while (!stack.empty())
+        {
+            uint32_t index = stack.back().first;
+            uint32_t depth = stack.back().second;
+            stack.pop_back();
+
+            NodeView n = node(index);
+            out << std::string(depth * 2, ' ');
+            out.write(n.value, n.length);
+            out << '\n';
+            for (uint32_t i = n.childCount; i > 0; --i)
+            {
+                stack.emplace_back(n.firstChild + i - 1, depth + 1);
+            }
+        }
+    }
+};
\ No newline at end of file
@@ -0,0 +1,101 @@
+// : BinaryReader   ,      .
+//  ,    :
+//   g++ -std=c++14 -O2 BinaryReaderTest.cpp -o BinaryReaderTest
+//   cl /std:c++14 /O2 /EHsc BinaryReaderTest.cpp
+//   0 -  .
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "BinaryFormat.h"
+#include "BinaryReader.h"
+
+struct TestNode
+{
+    uint32_t firstChild;
+    uint32_t childCount;
+};
+
+//     :     "x"
+static std::vector<unsigned char> makeFile(const std::vector<TestNode>& nodes)
+{
+    uint32_t nodesOffset = HEADER_SIZE;
+    uint32_t stringsOffset = nodesOffset + static_cast<uint32_t>(nodes.size()) * NODE_RECORD_SIZE;
+    const uint32_t stringsSize = 2;
+
+    std::vector<unsigned char> file(HEADER_SIZE);
+    writeU32(&file[4 * H_MAGIC], BINARY_MAGIC);
+    writeU32(&file[4 * H_VERSION], BINARY_VERSION);
+    writeU32(&file[4 * H_FILE_SIZE], stringsOffset + stringsSize);
+    writeU32(&file[4 * H_STRINGS_OFFSET], stringsOffset);
+    writeU32(&file[4 * H_STRINGS_SIZE], stringsSize);
+    writeU32(&file[4 * H_TOKENS_OFFSET], nodesOffset);
+    writeU32(&file[4 * H_TOKEN_COUNT], 0);
+    writeU32(&file[4 * H_SYMBOLS_OFFSET], nodesOffset);
+    writeU32(&file[4 * H_SYMBOL_COUNT], 0);
+    writeU32(&file[4 * H_NODES_OFFSET], nodesOffset);
+    writeU32(&file[4 * H_NODE_COUNT], static_cast<uint32_t>(nodes.size()));
+    writeU32(&file[4 * H_ROOT], nodes.empty() ? NO_NODE : 0);
+
+    file.reserve(stringsOffset + stringsSize);
+    for (const TestNode& node : nodes)
+    {
+        appendU32(file, stringsOffset);
+        appendU32(file, 1);
+        appendU32(file, node.childCount > 0 ? node.firstChild : NO_NODE);
+        appendU32(file, node.childCount);
+    }
+    file.push_back('x');
+    file.push_back('\0');
+    return file;
+}
+
+// :   i   i + 1
+static std::vector<TestNode> chain(uint32_t count)
+{
+    std::vector<TestNode> nodes(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        nodes[i] = { i + 1, i + 1 < count ? 1u : 0u };
+    }
+    return nodes;
+}
+
+static bool expect(const char* what, const std::vector<unsigned char>& file, bool valid)
+{
+    BinaryReader reader(file.data(), file.size());
+    bool ok = reader.isValid() == valid;
+    if (ok && valid)
+    {
+        std::ostringstream text;
+        reader.writeText(text);
+    }
+    std::cout << what << ": " << (reader.isValid() ? "" : "") << (ok ? "" : " - ") << '\n';
+    return ok;
+}
+
+int main()
+{
+    //    ,   -  
+    bool ok = expect("  ", makeFile({ { 1, 2 }, { 0, 0 }, { 3, 1 }, { 0, 0 } }), true);
+    ok = expect(" ", makeFile({}), true) && ok;
+    ok = expect("  MAX_TREE_DEPTH", makeFile(chain(BinaryReader::MAX_TREE_DEPTH + 1)), true) && ok;
+
+    // 2M ,    :  -     
+    ok = expect("  2M ", makeFile(chain(2000000)), false) && ok;
+
+    //   i  [i + 1, i + 3):    ,  -  
+    std::vector<TestNode> shared(60);
+    for (uint32_t i = 0; i < shared.size(); ++i)
+    {
+        shared[i] = { i + 1, i + 3 <= shared.size() ? 2u : 0u };
+    }
+    ok = expect(" ", makeFile(shared), false) && ok;
+
+    ok = expect("  ", makeFile({ { 2, 1 }, { 0, 0 }, { 0, 0 } }), false) && ok;
+    ok = expect("  ", makeFile({ { 0, 0 }, { 0, 0 } }), false) && ok;
+
+    std::cout << (ok ? "OK" : "") << '\n';
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <string>
+#include "Diagnostics.h"
+#include "HashTable.h"
+#include "LexicalAnalyzer.h"
+#include "SyntaxAnalyzer.h"
+#include "Token.h"
+
+//   .        compile()
+struct CompileResult
+{
+    TokenList tokens;
+    const HashTable* symbols;
+    const ParseTreeNode* tree; // nullptr,      
+    const Diagnostics* diagnostics;
+
+    bool ok() const { return diagnostics->size() == 0; }
+};
+
+//      .      :
+//   (, ,  , , )  ,
+//  ,           .
+//      :          .
+//  -         .
+//          .
+//   ( ),      .
+class CompilerContext
+{
+public:
+    // threadCount -     (0 -   )
+    explicit CompilerContext(size_t threadCount = 0)
+        : lexer(hashTable), parser(lexer, "")
+    {
+        lexer.setDiagnostics(&diagnostics);
+        parser.setDiagnostics(&diagnostics);
+        parser.setThreadCount(threadCount);
+    }
+
+    CompileResult compile(const char* data, size_t size)
+    {
+        diagnostics.clear();
+        hashTable.clear();
+        lexer.reset(data, size);
+
+        lexer.tokenize();
+        parser.analyze();
+
+        CompileResult result;
+        result.tokens = lexer.getTokens();
+        result.symbols = &hashTable;
+        result.tree = parser.getRoot();
+        result.diagnostics = &diagnostics;
+        return result;
+    }
+
+    CompileResult compile(const std::string& source)
+    {
+        return compile(source.data(), source.size());
+    }
+
+private:
+    HashTable hashTable;
+    Diagnostics diagnostics;
+    LexicalAnalyzer lexer;
+    SyntaxAnalyzer parser;
+};
\ No newline at end of file
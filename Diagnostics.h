@@ -0,0 +1,39 @@
+#pragma once
+#include <string>
+#include <vector>
+
+//    
+struct Diagnostic
+{
+    int line = 0;
+    std::string message;
+};
+
+//  . clear()   :     
+class Diagnostics
+{
+public:
+    Diagnostic& add(int line)
+    {
+        if (count == items.size())
+        {
+            items.emplace_back();
+        }
+        Diagnostic& d = items[count++];
+        d.line = line;
+        d.message.clear();
+        return d;
+    }
+
+    void clear()
+    {
+        count = 0;
+    }
+
+    size_t size() const { return count; }
+    const Diagnostic& operator[](size_t i) const { return items[i]; }
+
+private:
+    std::vector<Diagnostic> items;
+    size_t count = 0;
+};
\ No newline at end of file
@@ -0,0 +1,219 @@
+#pragma once
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+//    
+struct Buffer
+{
+    const void* data;
+    size_t size;
+};
+
+//     .  POSIX -  writev (    )
+inline bool writeBuffers(const std::string& filename, const std::vector<Buffer>& buffers)
+{
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        std::cerr << "   " << filename << '\n';
+        return false;
+    }
+    bool ok = true;
+    for (const Buffer& buffer : buffers)
+    {
+        const char* data = static_cast<const char*>(buffer.data);
+        size_t left = buffer.size;
+        while (ok && left > 0)
+        {
+            DWORD chunk = left > 0x40000000 ? 0x40000000 : static_cast<DWORD>(left);
+            DWORD written = 0;
+            ok = WriteFile(file, data, chunk, &written, nullptr) != 0;
+            data += written;
+            left -= written;
+        }
+    }
+    CloseHandle(file);
+#else
+    int fd = open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        std::cerr << "   " << filename << '\n';
+        return false;
+    }
+    std::vector<iovec> iov;
+    for (const Buffer& buffer : buffers)
+    {
+        if (buffer.size > 0)
+        {
+            iov.push_back({ const_cast<void*>(buffer.data), buffer.size });
+        }
+    }
+
+    bool ok = true;
+    size_t first = 0;
+    while (ok && first < iov.size())
+    {
+        int count = static_cast<int>(iov.size() - first);
+        if (count > IOV_MAX) count = IOV_MAX;
+
+        ssize_t written = writev(fd, &iov[first], count);
+        if (written < 0)
+        {
+            ok = false;
+            break;
+        }
+        //        
+        size_t done = static_cast<size_t>(written);
+        while (first < iov.size() && done >= iov[first].iov_len)
+        {
+            done -= iov[first].iov_len;
+            ++first;
+        }
+        if (first < iov.size())
+        {
+            iov[first].iov_base = static_cast<char*>(iov[first].iov_base) + done;
+            iov[first].iov_len -= done;
+        }
+    }
+    close(fd);
+#endif
+    if (!ok)
+    {
+        std::cerr << "    " << filename << '\n';
+    }
+    return ok;
+}
+
+//      (   ,    ).
+//     :  Windows -   100  (FILETIME),  - 
+inline bool fileStamp(const std::string& filename, uint64_t& modified, uint64_t& size)
+{
+#ifdef _WIN32
+    WIN32_FILE_ATTRIBUTE_DATA attributes;
+    if (!GetFileAttributesExA(filename.c_str(), GetFileExInfoStandard, &attributes)) return false;
+    modified = (static_cast<uint64_t>(attributes.ftLastWriteTime.dwHighDateTime) << 32) | attributes.ftLastWriteTime.dwLowDateTime;
+    size = (static_cast<uint64_t>(attributes.nFileSizeHigh) << 32) | attributes.nFileSizeLow;
+    return true;
+#else
+    struct stat st;
+    if (stat(filename.c_str(), &st) != 0) return false;
+#ifdef __linux__
+    modified = static_cast<uint64_t>(st.st_mtim.tv_sec) * 1000000000ULL + static_cast<uint64_t>(st.st_mtim.tv_nsec);
+#else
+    modified = static_cast<uint64_t>(st.st_mtime) * 1000000000ULL;
+#endif
+    size = static_cast<uint64_t>(st.st_size);
+    return true;
+#endif
+}
+
+//   to  from ( POSIX - )
+inline bool replaceFile(const std::string& from, const std::string& to)
+{
+#ifdef _WIN32
+    return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    return rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+//   (   -  )
+inline bool makeDirectory(const std::string& path)
+{
+#ifdef _WIN32
+    return CreateDirectoryA(path.c_str(), nullptr) != 0 || GetLastError() == ERROR_ALREADY_EXISTS;
+#else
+    return mkdir(path.c_str(), 0755) == 0 || errno == EEXIST;
+#endif
+}
+
+// ,      
+class MappedFile
+{
+public:
+    MappedFile(const std::string& filename)
+    {
+#ifdef _WIN32
+        file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return;
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize)) return;
+        length = static_cast<size_t>(fileSize.QuadPart);
+        opened = true;
+        if (length == 0) return;
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr)
+        {
+            opened = false;
+            return;
+        }
+        view = static_cast<const unsigned char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        opened = view != nullptr;
+#else
+        fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat st;
+        if (fstat(fd, &st) != 0) return;
+        length = static_cast<size_t>(st.st_size);
+        opened = true;
+        if (length == 0) return;
+        void* p = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED)
+        {
+            opened = false;
+            return;
+        }
+        view = static_cast<const unsigned char*>(p);
+#endif
+    }
+
+    ~MappedFile()
+    {
+#ifdef _WIN32
+        if (view) UnmapViewOfFile(view);
+        if (mapping) CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+#else
+        if (view) munmap(const_cast<unsigned char*>(view), length);
+        if (fd >= 0) close(fd);
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool isOpen() const { return opened; }
+    const unsigned char* data() const { return view; }
+    size_t size() const { return length; }
+
+private:
+    const unsigned char* view = nullptr;
+    size_t length = 0;
+    bool opened = false;
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#else
+    int fd = -1;
+#endif
+};
\ No newline at end of file
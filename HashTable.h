@@ -2,6 +2,7 @@
 #define HASH_TABLE_H
 
 #include "Token.h"
+#include <deque>
 #include <iostream>
 #include <fstream>
 #include <string>
@@ -23,6 +24,8 @@ private:
     OneToken* table[TABLE_SIZE];
     OneToken* insertionOrder[MAX_ENTRIES]; //     
     int insertionCount; //   
+    std::deque<OneToken> entries; //   ,   clear()
+    size_t usedEntries = 0;
 
 public:
     // 
@@ -38,25 +41,22 @@ public:
         }
     }
 
-    // 
-    ~HashTable()
+    //       
+    void clear()
     {
         for (int i = 0; i < TABLE_SIZE; ++i)
         {
-            OneToken* current = table[i];
-            while (current != nullptr) {
-                OneToken* temp = current;
-                current = current->next;
-                delete temp;
-            }
+            table[i] = nullptr;
         }
+        insertionCount = 0;
+        usedEntries = 0;
     }
 
     
     int hash(const std::string& lexeme) const
     {
         unsigned long hashValue = 5381; 
-        for (char c : lexeme) {
+        for (unsigned char c : lexeme) {
             hashValue = ((hashValue << 5) + hashValue) + c; //  5       hashValue * 33 + c
         }
         return hashValue % TABLE_SIZE; 
@@ -65,7 +65,7 @@ public:
     
     void insert(const Token& token)
     {
-        std::string lexeme = token.value;
+        const std::string& lexeme = token.value;
         TokenType type = token.type;
         int index = hash(lexeme);
 
@@ -81,7 +81,14 @@ public:
         }
 
         //    ,  
-        OneToken* newEntry = new OneToken{ type, lexeme, table[index] };
+        if (usedEntries == entries.size())
+        {
+            entries.emplace_back();
+        }
+        OneToken* newEntry = &entries[usedEntries++];
+        newEntry->type = type;
+        newEntry->lexeme = lexeme;
+        newEntry->next = table[index];
         table[index] = newEntry; //    
         if (insertionCount < MAX_ENTRIES)
         {
@@ -89,6 +96,18 @@ public:
         }
     }
 
+    //     
+    int size() const
+    {
+        return insertionCount;
+    }
+
+    //    
+    const OneToken* at(int i) const
+    {
+        return insertionOrder[i];
+    }
+
     //   
     void print() const
     {
@@ -120,7 +139,7 @@ public:
     }
 
     //    
-    std::string tokenTypeToString(TokenType type) const {
+    static std::string tokenTypeToString(TokenType type) {
         switch (type) {
         case TokenType::BEGIN: return "BEGIN";
         case TokenType::END: return "END";
@@ -0,0 +1,166 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "FileIO.h"
+#include "SymbolIndex.h"
+#include "SymbolIndexer.h"
+
+//     :  ,   ,
+//      (      ),
+//     ,          
+class IndexBenchmark
+{
+public:
+    IndexBenchmark(size_t fileCount, const std::string& directory)
+        : fileCount(fileCount), directory(directory)
+    {
+    }
+
+    int run()
+    {
+        if (!makeDirectory(directory))
+        {
+            std::cerr << ":     " << directory << '\n';
+            return 1;
+        }
+
+        std::vector<std::string> paths;
+        for (size_t i = 0; i < fileCount; ++i)
+        {
+            paths.push_back(directory + "/file_" + std::to_string(i) + ".txt");
+            writeSource(paths.back(), i, 0);
+        }
+        std::string indexFilename = directory + "/index.bin";
+        std::remove(indexFilename.c_str());
+
+        std::unique_ptr<SymbolIndexer> indexer(new SymbolIndexer());
+        double full = measure([&] { indexer->update(indexFilename, paths); });
+        report(" ", full, indexer->lexedFileCount());
+
+        double unchanged = measure([&] { indexer->update(indexFilename, paths); });
+        report("  ", unchanged, indexer->lexedFileCount());
+
+        writeSource(paths[fileCount / 2], fileCount / 2, 1);
+        double oneFile = measure([&] { indexer->update(indexFilename, paths); });
+        report("    ", oneFile, indexer->lexedFileCount());
+
+        writeSource(paths[fileCount / 2], fileCount / 2, 2);
+        double listed = measure([&] { indexer->updateFiles(indexFilename, { paths[fileCount / 2] }); });
+        report("     ", listed, indexer->lexedFileCount());
+
+        MappedFile file(indexFilename);
+        SymbolIndex index(file.data(), file.size());
+        if (!file.isOpen() || !index.isValid())
+        {
+            std::cerr << ":   " << indexFilename << '\n';
+            return 1;
+        }
+
+        const int QUERIES = 100000;
+        std::vector<std::string> queries;
+        for (int q = 0; q < QUERIES; ++q)
+        {
+            queries.push_back(identifier(random(q) % VOCABULARY));
+        }
+
+        uint64_t checksum = 0; //     
+
+        //     --query:  ,     
+        const int OPENS = 100;
+        double opened = measure([&]
+        {
+            for (int q = 0; q < OPENS; ++q)
+            {
+                MappedFile queryFile(indexFilename);
+                SymbolIndex queryIndex(queryFile.data(), queryFile.size());
+                const std::string& name = queries[q];
+                if (queryIndex.isValid() && queryIndex.find(name.data(), name.size()) != NO_SYMBOL) ++checksum;
+            }
+        });
+
+        double exact = measure([&]
+        {
+            for (const std::string& name : queries)
+            {
+                uint32_t s = index.find(name.data(), name.size());
+                if (s != NO_SYMBOL) checksum += index.posting(index.symbol(s).firstPosting).line;
+            }
+        });
+        double prefix = measure([&]
+        {
+            for (const std::string& name : queries)
+            {
+                uint32_t first, last;
+                index.findPrefix(name.data(), name.size() < 3 ? name.size() : 3, first, last);
+                checksum += last - first;
+            }
+        });
+
+        std::cout << ": " << index.fileCount() << ", : " << index.symbolCount()
+            << ", : " << index.postingCount() << ",  : " << file.size() << " \n";
+        std::cout << "    : " << opened * 1000000.0 / OPENS << " \n";
+        std::cout << " : " << exact * 1000000.0 / QUERIES << "   \n";
+        std::cout << "  : " << prefix * 1000000.0 / QUERIES << "   \n";
+        std::cout << "(  " << checksum << ")\n";
+        return 0;
+    }
+
+private:
+    static const uint32_t VOCABULARY = 50000; //     
+
+    size_t fileCount;
+    std::string directory;
+
+    static uint32_t random(uint64_t seed)
+    {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<uint32_t>(seed >> 33);
+    }
+
+    //     :   
+    static std::string identifier(uint32_t number)
+    {
+        std::string name = "v";
+        do
+        {
+            name += static_cast<char>('a' + number % 26);
+            number /= 26;
+        } while (number > 0);
+        return name;
+    }
+
+    void writeSource(const std::string& path, size_t fileNumber, int version)
+    {
+        std::ofstream out(path);
+        for (int f = 0; f < 3; ++f)
+        {
+            uint64_t seed = fileNumber * 16 + f * 4 + version;
+            out << "int " << identifier(random(seed) % VOCABULARY) << "() {\n";
+            out << "    int " << identifier(random(seed + 1) % VOCABULARY) << ", "
+                << identifier(random(seed + 2) % VOCABULARY) << " = 4;\n";
+            out << "    float " << identifier(random(seed + 3) % VOCABULARY) << " = itof(1.5) + 2;\n";
+            out << "    return " << identifier(random(seed + 1) % VOCABULARY) << ";\n}\n";
+        }
+        out << std::string(version, '\n'); //   
+    }
+
+    template <typename F>
+    static double measure(F action)
+    {
+        auto start = std::chrono::steady_clock::now();
+        action();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(end - start).count();
+    }
+
+    static void report(const char* what, double seconds, size_t lexed)
+    {
+        std::cout << what << ": " << seconds * 1000.0 << " ,  : " << lexed << '\n';
+    }
+};
\ No newline at end of file
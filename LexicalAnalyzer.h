@@ -1,10 +1,13 @@
 #pragma once
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include <unordered_map>
 #include <fstream>
+#include "Diagnostics.h"
 #include "HashTable.h"
 #include "Token.h"
+#include "Utf8.h"
 
 //  
 class LexicalAnalyzer
@@ -23,11 +26,31 @@ public:
         file.close();
     }
 
+    //   :    reset()
+    LexicalAnalyzer(HashTable& hashTable)
+        : position(0), hashTable(hashTable)
+    {
+    }
+
+    //    .         
+    void reset(const char* data, size_t size)
+    {
+        input.assign(data, size);
+        position = 0;
+        line = 1;
+        tokenCount = 0;
+    }
+
+    //    (nullptr -   std::cerr)
+    void setDiagnostics(Diagnostics* value)
+    {
+        diagnostics = value;
+    }
+
     // 
     void tokenize()
     {
-        Token lastToken = { TokenType::UNKNOWN, "" }; //   
-       
+        checkEncoding();
 
         while (position < input.size())
         {
@@ -35,74 +58,148 @@ public:
 
             if (currentChar == '\n') ++line;
             
+            size_t length;
+            CharClass charClass = classAt(position, length);
+
             //   
-            if (isspace(currentChar))
+            if (charClass == CHAR_SPACE)
             {
                 ++position;
                 continue;
             }
 
+            std::pair<Token, int>& slot = nextSlot();
+            slot.second = line;
+
             //   
-            if (isalpha(currentChar))
+            if (charClass == CHAR_LETTER)
             {
-                Token currentToken = parseIdentifierOrKeyword(); 
-                hashTable.insert(currentToken); 
-                tokens.push_back(std::make_pair(currentToken, line));
-                lastToken = currentToken;
+                parseIdentifierOrKeyword(slot.first); 
             }
-            else if (isdigit(currentChar))
+            else if (charClass == CHAR_DIGIT)
             {
-                Token currentToken = parseNumber();
-                hashTable.insert(currentToken);
-                tokens.push_back(std::make_pair(currentToken, line));
-                lastToken = currentToken;
+                parseNumber(slot.first);
             }
             else
             {
-                Token currentToken = parseOperator();
-                hashTable.insert(currentToken);
-                tokens.push_back(std::make_pair(currentToken, line));
-                lastToken = currentToken;
+                parseOperator(slot.first);
             }
+            hashTable.insert(slot.first); 
         }
     }
-    std::vector<std::pair<Token, int>> getTokens() {
-        return tokens; //   
+    TokenList getTokens() const {
+        TokenList list;
+        list.items = tokens.data();
+        list.count = tokenCount;
+        return list; //    
     }
 
 private:
     std::string input; 
     size_t position; 
     HashTable& hashTable; 
-    std::vector<std::pair<Token, int>> tokens; //    
+    std::vector<std::pair<Token, int>> tokens; //     (  tokenCount)
+    size_t tokenCount = 0;
     std::vector<int> lines;
     int line = 1;
-    
+    Diagnostics* diagnostics = nullptr;
+
+    //    :    
+    std::pair<Token, int>& nextSlot()
+    {
+        if (tokenCount == tokens.size())
+        {
+            tokens.emplace_back();
+        }
+        return tokens[tokenCount++];
+    }
+
+    void reportError(int errorLine, const char* before, const std::string& value, const char* after)
+    {
+        if (diagnostics)
+        {
+            std::string& message = diagnostics->add(errorLine).message;
+            message.append(before).append(value).append(after);
+        }
+        else
+        {
+            std::cerr << before << value << after << std::endl;
+        }
+    }
+
+    //  BOM  ,   -  UTF-8.
+    //      UNKNOWN
+    void checkEncoding()
+    {
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(input.data());
+        if (position == 0 && input.size() >= 3 && bytes[0] == 0xEF && bytes[1] == 0xBB && bytes[2] == 0xBF)
+        {
+            position = 3;
+        }
+
+        size_t invalid = position + validateUtf8(bytes + position, input.size() - position);
+        if (invalid < input.size())
+        {
+            int invalidLine = line + static_cast<int>(std::count(input.begin() + position, input.begin() + invalid, '\n'));
+            reportError(invalidLine, "Error:   UTF-8   ", std::to_string(invalidLine), ".");
+        }
+    }
 
-    Token parseIdentifierOrKeyword()
+    //     pos     .
+    //    ASCII    Unicode,   - CHAR_OTHER  1
+    CharClass classAt(size_t pos, size_t& length) const
+    {
+        unsigned char c = static_cast<unsigned char>(input[pos]);
+        if (c < 0x80)
+        {
+            length = 1;
+            return asciiClass(c);
+        }
+
+        uint32_t codePoint;
+        int n = decodeUtf8(reinterpret_cast<const unsigned char*>(input.data()) + pos, input.size() - pos, codePoint);
+        if (n == 0)
+        {
+            length = 1;
+            return CHAR_OTHER;
+        }
+        length = n;
+        return isUnicodeLetter(codePoint) ? CHAR_LETTER : CHAR_OTHER;
+    }
+
+    bool isDigitAt(size_t pos) const
+    {
+        return input[pos] >= '0' && input[pos] <= '9';
+    }
+
+    void parseIdentifierOrKeyword(Token& token)
     {
         size_t start = position;
         bool hasDigit = false; //  
 
-        while (position < input.size() &&
-           (isalnum(input[position]) || input[position] == '_')) //     
+        while (position < input.size()) //  (    ),   '_'
     {
-        if (isdigit(input[position])) {
+        size_t length;
+        CharClass charClass = classAt(position, length);
+        if (charClass == CHAR_DIGIT) {
             hasDigit = true;
         }
-        ++position;
+        else if (charClass != CHAR_LETTER && input[position] != '_') {
+            break;
+        }
+        position += length;
     }
 
-        std::string value = input.substr(start, position - start);
+        token.value.assign(input, start, position - start);
 
         //    ,  
         if (hasDigit) {
-            std::cerr << "Error:  '" << value << "'    ." << std::endl;
-            return { TokenType::UNKNOWN, value }; //  UNKNOWN 
+            reportError(line, "Error:  '", token.value, "'    .");
+            token.type = TokenType::UNKNOWN; //  UNKNOWN 
+            return;
         }
 
-        TokenType type = identifyKeyword(value);
-        return { type, value };
+        token.type = identifyKeyword(token.value);
     }
     //,    
     TokenType identifyKeyword(const std::string& value)
@@ -124,12 +221,11 @@ private:
 
     
     // ,    
-    Token parseNumber()
+    void parseNumber(Token& token)
     {
         size_t start = position; 
-        bool hasDecimalPoint = false; //  
 
-        while (position < input.size() && isdigit(input[position]))
+        while (position < input.size() && isDigitAt(position))
         {
             position++;
         }
@@ -137,10 +233,9 @@ private:
         //     
         if (position < input.size() && input[position] == '.')
         {
-            hasDecimalPoint = true; 
             position++; 
 
-            while (position < input.size() && isdigit(input[position]))
+            while (position < input.size() && isDigitAt(position))
             {
                 position++;
             }
@@ -149,33 +244,42 @@ private:
             if (position < input.size() && input[position] == '.')
             {
                 position++;
-                std::cerr << "Error:    '" << input.substr(start, position - start + 1) << "'." << std::endl;
-                return { TokenType::UNKNOWN, input.substr(start, position - start +1) }; //  UNKNOWN 
+                token.value.assign(input, start, position - start + 1);
+                reportError(line, "Error:    '", token.value, "'.");
+                token.type = TokenType::UNKNOWN; //  UNKNOWN 
+                return;
             }
 
-            return { TokenType::FLOAT_NUM, input.substr(start, position - start) };
+            token.type = TokenType::FLOAT_NUM;
+            token.value.assign(input, start, position - start);
+            return;
         }
 
         //     ,   
-        return { TokenType::INT_NUM, input.substr(start, position - start) }; 
+        token.type = TokenType::INT_NUM;
+        token.value.assign(input, start, position - start); 
     }
 
     //  
-    Token parseOperator()
+    void parseOperator(Token& token)
     {
-        char currentChar = input[position++];
+        size_t length;
+        classAt(position, length); //    ASCII      UNKNOWN
+        char currentChar = input[position];
+        token.value.assign(input, position, length);
+        position += length;
         switch (currentChar)
         {
-        case '=': return { TokenType::ASSIGN, "=" };
-        case '+': return { TokenType::PLUS, "+" };
-        case '-': return { TokenType::MINUS, "-" };
-        case ',': return { TokenType::COMMA, "," };
-        case ';': return { TokenType::SEMICOLON, ";" };
-        case '(': return { TokenType::LPAREN, "(" };
-        case ')': return { TokenType::RPAREN, ")" };
-        case '{': return { TokenType::LBRACE, "{" };
-        case '}': return { TokenType::RBRACE, "}" };
-        default: return { TokenType::UNKNOWN, std::string(1, currentChar) };
+        case '=': token.type = TokenType::ASSIGN; break;
+        case '+': token.type = TokenType::PLUS; break;
+        case '-': token.type = TokenType::MINUS; break;
+        case ',': token.type = TokenType::COMMA; break;
+        case ';': token.type = TokenType::SEMICOLON; break;
+        case '(': token.type = TokenType::LPAREN; break;
+        case ')': token.type = TokenType::RPAREN; break;
+        case '{': token.type = TokenType::LBRACE; break;
+        case '}': token.type = TokenType::RBRACE; break;
+        default: token.type = TokenType::UNKNOWN; break;
         }
     }
 };
\ No newline at end of file
@@ -4,13 +4,133 @@
 #include "LexicalAnalyzer.h"
 #include "HashTable.h"
 #include "SyntaxAnalyzer.h"
+#include "BinaryExport.h"
+#include "BinaryReader.h"
+#include "FileIO.h"
+#include "IndexBenchmark.h"
+#include "SymbolIndex.h"
+#include "SymbolIndexer.h"
 #include <fstream>
+#include <memory>
+#include <vector>
 
-int main()
+//   : :  /
+static void printPostings(const SymbolIndex& index, uint32_t s)
+{
+    IndexedSymbol symbol = index.symbol(s);
+    for (uint32_t p = symbol.firstPosting; p < symbol.firstPosting + symbol.postingCount; ++p)
+    {
+        Posting posting = index.posting(p);
+        IndexedFile file = index.file(posting.file);
+        std::cout.write(file.path, file.length);
+        std::cout << ':' << posting.line << ' ';
+        std::cout.write(symbol.name, symbol.length);
+        std::cout << ' ' << HashTable::tokenTypeToString(posting.type)
+            << ((posting.flags & POSTING_DECLARATION) ? " " : " ") << '\n';
+    }
+}
+
+//       first (@list.txt -      )
+static std::vector<std::string> readPaths(int argc, char* argv[], int first)
+{
+    std::vector<std::string> paths;
+    for (int i = first; i < argc; ++i)
+    {
+        if (argv[i][0] == '@')
+        {
+            std::ifstream list(argv[i] + 1);
+            std::string path;
+            while (std::getline(list, path))
+            {
+                if (!path.empty() && path.back() == '\r') path.pop_back();
+                if (!path.empty()) paths.push_back(path);
+            }
+        }
+        else
+        {
+            paths.push_back(argv[i]);
+        }
+    }
+    return paths;
+}
+
+int main(int argc, char* argv[])
 {
     setlocale(LC_ALL, "ru");
+
+    // proba --to-text file.bin :      
+    if (argc == 3 && std::string(argv[1]) == "--to-text")
+    {
+        MappedFile file(argv[2]);
+        BinaryReader reader(file.data(), file.size());
+        if (!file.isOpen() || !reader.isValid())
+        {
+            std::cerr << ":    " << argv[2] << '\n';
+            return 1;
+        }
+        reader.writeText(std::cout);
+        return 0;
+    }
+
+    // proba --index index.bin file... :     
+    //     (,    ,   )
+    // proba --index-update index.bin file... :    ,
+    //    
+    // (@list.txt -      )
+    if (argc >= 3 && (std::string(argv[1]) == "--index" || std::string(argv[1]) == "--index-update"))
+    {
+        std::vector<std::string> paths = readPaths(argc, argv, 3);
+        std::unique_ptr<SymbolIndexer> indexer(new SymbolIndexer());
+        bool ok = std::string(argv[1]) == "--index"
+            ? indexer->update(argv[2], paths)
+            : indexer->updateFiles(argv[2], paths);
+        if (!ok) return 1;
+        std::cout << "  : " << indexer->fileCount() << ", : " << indexer->lexedFileCount() << '\n';
+        return 0;
+    }
+
+    // proba --query index.bin name :    (name* -   )
+    if (argc == 4 && std::string(argv[1]) == "--query")
+    {
+        MappedFile file(argv[2]);
+        SymbolIndex index(file.data(), file.size());
+        if (!file.isOpen() || !index.isValid())
+        {
+            std::cerr << ":   " << argv[2] << '\n';
+            return 1;
+        }
+
+        //     ,       
+        std::string name = argv[3];
+        uint32_t first, last;
+        if (!name.empty() && name.back() == '*')
+        {
+            index.findPrefix(name.data(), name.size() - 1, first, last);
+        }
+        else
+        {
+            first = index.find(name.data(), name.size());
+            last = first == NO_SYMBOL ? first : first + 1;
+        }
+        if (!index.isValid())
+        {
+            std::cerr << ":   " << argv[2] << '\n';
+            return 1;
+        }
+        for (uint32_t s = first; s < last; ++s) printPostings(index, s);
+        return 0;
+    }
+
+    // proba --index-bench N dir :    N     dir
+    if (argc == 4 && std::string(argv[1]) == "--index-bench")
+    {
+        IndexBenchmark benchmark(std::stoul(argv[2]), argv[3]);
+        return benchmark.run();
+    }
+
     std::string filename = "input.txt";
     std::string outputFilename = "output.txt"; //      
+    std::string binaryFilename = "output.bin"; //     
 
     HashTable hashTable;
     LexicalAnalyzer lexicalAnalyzer(filename, hashTable);
@@ -25,5 +145,8 @@ int main()
    
     syntaxAnalyzer.parse(); 
 
+    BinaryExporter exporter(lexicalAnalyzer.getTokens(), hashTable, syntaxAnalyzer.getRoot());
+    exporter.write(binaryFilename);
+
     return 0;
 }
\ No newline at end of file
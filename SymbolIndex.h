@@ -0,0 +1,255 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "BinaryFormat.h"
+#include "Token.h"
+
+//     .  - uint32 little-endian,  -    .
+//
+//  (INDEX_HEADER_SIZE ):
+//   magic, version,  ,
+//      ,
+//      ,
+//      ,
+//       
+// :       ,  ,   (2 ),  (2 )
+// :     ,  ,  ,  
+// :  , , ,  (POSTING_DECLARATION)
+//   - TYPE_INT  TYPE_FLOAT  ;   -   
+//      ; ID -   (  ,  itof  ..).
+//     (),   -    .
+
+const uint32_t INDEX_MAGIC = 0x58444943; // "CIDX"
+const uint32_t INDEX_VERSION = 2; // 2:   -   
+
+const uint32_t INDEX_HEADER_FIELDS = 11;
+const uint32_t INDEX_HEADER_SIZE = INDEX_HEADER_FIELDS * 4;
+const uint32_t FILE_RECORD_SIZE = 24;
+const uint32_t INDEX_SYMBOL_RECORD_SIZE = 16;
+const uint32_t POSTING_RECORD_SIZE = 16;
+
+const uint32_t POSTING_DECLARATION = 1; //   ( int/float)
+const uint32_t NO_SYMBOL = 0xFFFFFFFF;
+
+//   
+enum IndexHeaderField
+{
+    I_MAGIC, I_VERSION, I_FILE_SIZE,
+    I_FILES_OFFSET, I_FILE_COUNT,
+    I_SYMBOLS_OFFSET, I_SYMBOL_COUNT,
+    I_POSTINGS_OFFSET, I_POSTING_COUNT,
+    I_STRINGS_OFFSET, I_STRINGS_SIZE
+};
+
+struct IndexedFile
+{
+    const char* path;
+    uint32_t length;
+    uint64_t modified;
+    uint64_t size;
+};
+
+struct IndexedSymbol
+{
+    const char* name;
+    uint32_t length;
+    uint32_t firstPosting;
+    uint32_t postingCount;
+};
+
+struct Posting
+{
+    uint32_t file;
+    uint32_t line;
+    TokenType type;
+    uint32_t flags;
+};
+
+//      ,     .
+//     ,  -   ,    :
+// find  findPrefix   ,    -    .
+//      ,    ,  isValid()  false.
+class SymbolIndex
+{
+public:
+    SymbolIndex(const unsigned char* data, size_t size)
+        : data(data), length(size)
+    {
+        valid = checkHeader();
+    }
+
+    bool isValid() const { return valid && !damaged; }
+
+    //       (     )
+    bool checkAll() const
+    {
+        if (!isValid()) return false;
+        for (uint32_t i = 0; i < fileCount(); ++i)
+        {
+            IndexedFile f = file(i);
+            if (!isString(f.path, f.length)) return false;
+        }
+        for (uint32_t i = 0; i < symbolCount(); ++i)
+        {
+            IndexedSymbol s = symbol(i);
+            if (!isString(s.name, s.length) || !isPostingRange(s)) return false;
+        }
+        for (uint32_t i = 0; i < postingCount(); ++i)
+        {
+            if (posting(i).file >= fileCount()) return false;
+        }
+        return true;
+    }
+
+    uint32_t fileCount() const { return field(I_FILE_COUNT); }
+    uint32_t symbolCount() const { return field(I_SYMBOL_COUNT); }
+    uint32_t postingCount() const { return field(I_POSTING_COUNT); }
+
+    IndexedFile file(uint32_t i) const
+    {
+        const unsigned char* p = data + field(I_FILES_OFFSET) + i * FILE_RECORD_SIZE;
+        return { text(readU32(p)), readU32(p + 4),
+            readU32(p + 8) | (uint64_t(readU32(p + 12)) << 32),
+            readU32(p + 16) | (uint64_t(readU32(p + 20)) << 32) };
+    }
+
+    IndexedSymbol symbol(uint32_t i) const
+    {
+        const unsigned char* p = data + field(I_SYMBOLS_OFFSET) + i * INDEX_SYMBOL_RECORD_SIZE;
+        return { text(readU32(p)), readU32(p + 4), readU32(p + 8), readU32(p + 12) };
+    }
+
+    Posting posting(uint32_t i) const
+    {
+        const unsigned char* p = data + field(I_POSTINGS_OFFSET) + i * POSTING_RECORD_SIZE;
+        return { readU32(p), readU32(p + 4), static_cast<TokenType>(readU32(p + 8)), readU32(p + 12) };
+    }
+
+    //        NO_SYMBOL
+    uint32_t find(const char* name, size_t nameLength) const
+    {
+        uint32_t i = lowerBound(name, nameLength);
+        if (!damaged && i < symbolCount() && compare(i, name, nameLength) == 0 && checkFound(i))
+        {
+            return i;
+        }
+        return NO_SYMBOL;
+    }
+
+    //   ,   prefix: [first, last)
+    void findPrefix(const char* prefix, size_t prefixLength, uint32_t& first, uint32_t& last) const
+    {
+        first = lowerBound(prefix, prefixLength);
+        last = first;
+        while (!damaged && last < symbolCount())
+        {
+            IndexedSymbol s = symbol(last);
+            if (!isString(s.name, s.length))
+            {
+                damaged = true;
+                break;
+            }
+            if (s.length < prefixLength || std::memcmp(s.name, prefix, prefixLength) != 0) break;
+            if (!checkFound(last)) break;
+            ++last;
+        }
+        if (damaged) last = first;
+    }
+
+private:
+    const unsigned char* data;
+    size_t length;
+    bool valid = false;
+    mutable bool damaged = false; //    
+
+    uint32_t field(IndexHeaderField f) const
+    {
+        return readU32(data + 4 * f);
+    }
+
+    const char* text(uint32_t offset) const
+    {
+        return reinterpret_cast<const char*>(data + offset);
+    }
+
+    //     i  name
+    int compare(uint32_t i, const char* name, size_t nameLength) const
+    {
+        IndexedSymbol s = symbol(i);
+        if (!isString(s.name, s.length))
+        {
+            damaged = true;
+            return 1; //  ,     
+        }
+        size_t common = s.length < nameLength ? s.length : nameLength;
+        int result = std::memcmp(s.name, name, common);
+        if (result != 0) return result;
+        if (s.length == nameLength) return 0;
+        return s.length < nameLength ? -1 : 1;
+    }
+
+    //       name
+    uint32_t lowerBound(const char* name, size_t nameLength) const
+    {
+        uint32_t low = 0;
+        uint32_t high = symbolCount();
+        while (low < high)
+        {
+            uint32_t middle = low + (high - low) / 2;
+            if (compare(middle, name, nameLength) < 0)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        return low;
+    }
+
+    bool inside(uint32_t offset, uint32_t count, uint32_t recordSize) const
+    {
+        return offset <= length && uint64_t(count) * recordSize <= length - offset;
+    }
+
+    bool checkHeader() const
+    {
+        if (data == nullptr || length < INDEX_HEADER_SIZE) return false;
+        if (field(I_MAGIC) != INDEX_MAGIC || field(I_VERSION) != INDEX_VERSION) return false;
+        if (field(I_FILE_SIZE) != length) return false;
+        return inside(field(I_STRINGS_OFFSET), field(I_STRINGS_SIZE), 1)
+            && inside(field(I_FILES_OFFSET), fileCount(), FILE_RECORD_SIZE)
+            && inside(field(I_SYMBOLS_OFFSET), symbolCount(), INDEX_SYMBOL_RECORD_SIZE)
+            && inside(field(I_POSTINGS_OFFSET), postingCount(), POSTING_RECORD_SIZE);
+    }
+
+    bool isPostingRange(const IndexedSymbol& s) const
+    {
+        return uint64_t(s.firstPosting) + s.postingCount <= postingCount();
+    }
+
+    //    (  ):    ,    
+    bool checkFound(uint32_t i) const
+    {
+        IndexedSymbol s = symbol(i);
+        bool ok = isPostingRange(s);
+        for (uint32_t p = s.firstPosting; ok && p < s.firstPosting + s.postingCount; ++p)
+        {
+            uint32_t f = posting(p).file;
+            ok = f < fileCount() && isString(file(f).path, file(f).length);
+        }
+        if (!ok) damaged = true;
+        return ok;
+    }
+
+    //  [value, value + length)       
+    bool isString(const char* value, uint32_t stringLength) const
+    {
+        uint64_t offset = reinterpret_cast<const unsigned char*>(value) - data;
+        uint64_t begin = field(I_STRINGS_OFFSET);
+        uint64_t end = begin + field(I_STRINGS_SIZE);
+        return offset >= begin && offset + stringLength < end && value[stringLength] == '\0';
+    }
+};
\ No newline at end of file
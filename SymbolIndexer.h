@@ -0,0 +1,331 @@
+#pragma once
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "BinaryFormat.h"
+#include "Diagnostics.h"
+#include "FileIO.h"
+#include "HashTable.h"
+#include "LexicalAnalyzer.h"
+#include "SymbolIndex.h"
+#include "Token.h"
+
+//       ( - . SymbolIndex.h).
+//           
+//  :      .
+//   (   ),      .
+class SymbolIndexer
+{
+public:
+    SymbolIndexer()
+        : lexer(hashTable)
+    {
+        lexer.setDiagnostics(&diagnostics);
+    }
+
+    //      paths.    ,    ,   
+    bool update(const std::string& indexFilename, const std::vector<std::string>& paths)
+    {
+        return build(indexFilename, paths, false);
+    }
+
+    //    :  ,   
+    //   ,           
+    bool updateFiles(const std::string& indexFilename, const std::vector<std::string>& paths)
+    {
+        return build(indexFilename, paths, true);
+    }
+
+    //       update()  updateFiles()
+    size_t lexedFileCount() const { return lexedFiles; }
+    size_t fileCount() const { return files.size(); }
+
+private:
+    struct FileEntry
+    {
+        std::string path;
+        uint64_t modified = 0;
+        uint64_t size = 0;
+    };
+
+    HashTable hashTable;
+    Diagnostics diagnostics; //      
+    LexicalAnalyzer lexer;
+
+    std::vector<FileEntry> files;
+    std::unordered_map<std::string, uint32_t> symbolIds;
+    std::vector<std::string> names;
+    std::vector<std::vector<Posting>> postings; //    
+    std::unordered_map<std::string, TokenType> declaredTypes; //      
+    size_t lexedFiles = 0;
+
+    bool build(const std::string& indexFilename, const std::vector<std::string>& paths, bool keepUnlisted)
+    {
+        files.clear();
+        symbolIds.clear();
+        names.clear();
+        postings.clear();
+        lexedFiles = 0;
+
+        std::vector<bool> reused;
+        {
+            MappedFile oldFile(indexFilename);
+            SymbolIndex oldIndex(oldFile.data(), oldFile.size());
+            bool hasOld = oldFile.isOpen() && oldIndex.checkAll(); //    
+
+            std::unordered_map<std::string, uint32_t> fileIds;
+            if (keepUnlisted && hasOld)
+            {
+                keepFiles(oldIndex, paths, fileIds);
+            }
+            for (const std::string& path : paths)
+            {
+                if (fileIds.count(path)) continue;
+                FileEntry entry;
+                entry.path = path;
+                if (!fileStamp(path, entry.modified, entry.size))
+                {
+                    if (!keepUnlisted) std::cerr << "Error:    " << path << '\n';
+                    continue; //     -  
+                }
+                fileIds.emplace(path, static_cast<uint32_t>(files.size()));
+                files.push_back(entry);
+            }
+
+            reused.assign(files.size(), false);
+            if (hasOld)
+            {
+                reuseUnchanged(oldIndex, fileIds, reused);
+            }
+        } //      
+
+        for (uint32_t i = 0; i < files.size(); ++i)
+        {
+            if (!reused[i])
+            {
+                indexFile(i);
+            }
+        }
+
+        std::string tempFilename = indexFilename + ".tmp";
+        if (!write(tempFilename)) return false;
+        if (!replaceFile(tempFilename, indexFilename))
+        {
+            std::cerr << "    " << indexFilename << '\n';
+            return false;
+        }
+        return true;
+    }
+
+    //   ,    paths,      ,
+    //  reuseUnchanged       
+    void keepFiles(const SymbolIndex& oldIndex, const std::vector<std::string>& paths,
+        std::unordered_map<std::string, uint32_t>& fileIds)
+    {
+        std::unordered_set<std::string> listed(paths.begin(), paths.end());
+        for (uint32_t i = 0; i < oldIndex.fileCount(); ++i)
+        {
+            IndexedFile old = oldIndex.file(i);
+            FileEntry entry;
+            entry.path.assign(old.path, old.length);
+            if (listed.count(entry.path) || fileIds.count(entry.path)) continue;
+            entry.modified = old.modified;
+            entry.size = old.size;
+            fileIds.emplace(entry.path, static_cast<uint32_t>(files.size()));
+            files.push_back(entry);
+        }
+    }
+
+    std::vector<Posting>& postingsOf(const char* name, size_t length)
+    {
+        std::string key(name, length);
+        auto it = symbolIds.find(key);
+        if (it == symbolIds.end())
+        {
+            it = symbolIds.emplace(key, static_cast<uint32_t>(names.size())).first;
+            names.push_back(key);
+            postings.emplace_back();
+        }
+        return postings[it->second];
+    }
+
+    //       ,   
+    void reuseUnchanged(const SymbolIndex& oldIndex, const std::unordered_map<std::string, uint32_t>& fileIds,
+        std::vector<bool>& reused)
+    {
+        const uint32_t NO_FILE = 0xFFFFFFFF;
+        std::vector<uint32_t> remap(oldIndex.fileCount(), NO_FILE);
+        bool any = false;
+        for (uint32_t i = 0; i < oldIndex.fileCount(); ++i)
+        {
+            IndexedFile old = oldIndex.file(i);
+            auto it = fileIds.find(std::string(old.path, old.length));
+            if (it == fileIds.end()) continue;
+            const FileEntry& entry = files[it->second];
+            if (entry.modified == old.modified && entry.size == old.size)
+            {
+                remap[i] = it->second;
+                reused[it->second] = true;
+                any = true;
+            }
+        }
+        if (!any) return;
+
+        for (uint32_t s = 0; s < oldIndex.symbolCount(); ++s)
+        {
+            IndexedSymbol symbol = oldIndex.symbol(s);
+            std::vector<Posting>* list = nullptr;
+            for (uint32_t p = symbol.firstPosting; p < symbol.firstPosting + symbol.postingCount; ++p)
+            {
+                Posting posting = oldIndex.posting(p);
+                if (posting.file >= remap.size() || remap[posting.file] == NO_FILE) continue;
+                posting.file = remap[posting.file];
+                if (!list) list = &postingsOf(symbol.name, symbol.length);
+                list->push_back(posting);
+            }
+        }
+    }
+
+    //        
+    void indexFile(uint32_t fileId)
+    {
+        MappedFile file(files[fileId].path);
+        if (!file.isOpen())
+        {
+            std::cerr << "Error:    " << files[fileId].path << '\n';
+            return;
+        }
+        ++lexedFiles;
+
+        diagnostics.clear();
+        hashTable.clear();
+        lexer.reset(reinterpret_cast<const char*>(file.data()), file.size());
+        lexer.tokenize();
+
+        //   int/float (   ) -   .
+        //       ,   - ID
+        declaredTypes.clear();
+        bool inDeclaration = false;
+        TokenType declaredType = TokenType::ID;
+        for (const std::pair<Token, int>& token : lexer.getTokens())
+        {
+            switch (token.first.type)
+            {
+            case TokenType::TYPE_INT:
+            case TokenType::TYPE_FLOAT:
+                inDeclaration = true;
+                declaredType = token.first.type;
+                break;
+            case TokenType::ID:
+            {
+                Posting posting = { fileId, static_cast<uint32_t>(token.second), TokenType::ID, 0 };
+                if (inDeclaration)
+                {
+                    posting.type = declaredType;
+                    posting.flags = POSTING_DECLARATION;
+                    declaredTypes[token.first.value] = declaredType;
+                }
+                else
+                {
+                    auto it = declaredTypes.find(token.first.value);
+                    if (it != declaredTypes.end()) posting.type = it->second;
+                }
+                postingsOf(token.first.value.data(), token.first.value.size()).push_back(posting);
+                break;
+            }
+            case TokenType::COMMA:
+                break;
+            default:
+                inDeclaration = false;
+                break;
+            }
+        }
+    }
+
+    bool write(const std::string& filename)
+    {
+        std::vector<char> strings;
+        auto addString = [&strings](const std::string& value)
+        {
+            uint32_t offset = static_cast<uint32_t>(strings.size());
+            strings.insert(strings.end(), value.begin(), value.end());
+            strings.push_back('\0');
+            return offset;
+        };
+
+        std::vector<uint32_t> order(names.size());
+        for (uint32_t i = 0; i < order.size(); ++i) order[i] = i;
+        std::sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) { return names[a] < names[b]; });
+
+        size_t postingCount = 0;
+        for (const std::vector<Posting>& list : postings) postingCount += list.size();
+
+        uint32_t filesOffset = INDEX_HEADER_SIZE;
+        uint32_t symbolsOffset = filesOffset + static_cast<uint32_t>(files.size()) * FILE_RECORD_SIZE;
+        uint32_t postingsOffset = symbolsOffset + static_cast<uint32_t>(names.size()) * INDEX_SYMBOL_RECORD_SIZE;
+        uint32_t stringsOffset = postingsOffset + static_cast<uint32_t>(postingCount) * POSTING_RECORD_SIZE;
+
+        std::vector<unsigned char> fileTable;
+        fileTable.reserve(files.size() * FILE_RECORD_SIZE);
+        for (const FileEntry& entry : files)
+        {
+            appendU32(fileTable, stringsOffset + addString(entry.path));
+            appendU32(fileTable, static_cast<uint32_t>(entry.path.size()));
+            appendU32(fileTable, static_cast<uint32_t>(entry.modified));
+            appendU32(fileTable, static_cast<uint32_t>(entry.modified >> 32));
+            appendU32(fileTable, static_cast<uint32_t>(entry.size));
+            appendU32(fileTable, static_cast<uint32_t>(entry.size >> 32));
+        }
+
+        std::vector<unsigned char> symbolTable;
+        std::vector<unsigned char> postingTable;
+        symbolTable.reserve(names.size() * INDEX_SYMBOL_RECORD_SIZE);
+        postingTable.reserve(postingCount * POSTING_RECORD_SIZE);
+        uint32_t nextPosting = 0;
+        for (uint32_t id : order)
+        {
+            std::vector<Posting>& list = postings[id];
+            std::sort(list.begin(), list.end(), [](const Posting& a, const Posting& b)
+            {
+                return a.file != b.file ? a.file < b.file : a.line < b.line;
+            });
+
+            appendU32(symbolTable, stringsOffset + addString(names[id]));
+            appendU32(symbolTable, static_cast<uint32_t>(names[id].size()));
+            appendU32(symbolTable, nextPosting);
+            appendU32(symbolTable, static_cast<uint32_t>(list.size()));
+            nextPosting += static_cast<uint32_t>(list.size());
+
+            for (const Posting& posting : list)
+            {
+                appendU32(postingTable, posting.file);
+                appendU32(postingTable, posting.line);
+                appendU32(postingTable, static_cast<uint32_t>(posting.type));
+                appendU32(postingTable, posting.flags);
+            }
+        }
+
+        unsigned char header[INDEX_HEADER_SIZE];
+        writeU32(header + 4 * I_MAGIC, INDEX_MAGIC);
+        writeU32(header + 4 * I_VERSION, INDEX_VERSION);
+        writeU32(header + 4 * I_FILE_SIZE, stringsOffset + static_cast<uint32_t>(strings.size()));
+        writeU32(header + 4 * I_FILES_OFFSET, filesOffset);
+        writeU32(header + 4 * I_FILE_COUNT, static_cast<uint32_t>(files.size()));
+        writeU32(header + 4 * I_SYMBOLS_OFFSET, symbolsOffset);
+        writeU32(header + 4 * I_SYMBOL_COUNT, static_cast<uint32_t>(names.size()));
+        writeU32(header + 4 * I_POSTINGS_OFFSET, postingsOffset);
+        writeU32(header + 4 * I_POSTING_COUNT, static_cast<uint32_t>(postingCount));
+        writeU32(header + 4 * I_STRINGS_OFFSET, stringsOffset);
+        writeU32(header + 4 * I_STRINGS_SIZE, static_cast<uint32_t>(strings.size()));
+
+        return writeBuffers(filename, {
+            { header, sizeof(header) },
+            { fileTable.data(), fileTable.size() },
+            { symbolTable.data(), symbolTable.size() },
+            { postingTable.data(), postingTable.size() },
+            { strings.data(), strings.size() }
+        });
+    }
+};
\ No newline at end of file
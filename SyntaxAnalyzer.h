@@ -1,9 +1,15 @@
 #pragma once
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <iostream>
 #include <fstream>
-#include <memory> //    
+#include <mutex>
+#include <stdexcept>
+#include <thread>
 #include <vector>
 #include <string>
+#include "Diagnostics.h"
 #include "LexicalAnalyzer.h"
 
 
@@ -13,73 +19,115 @@
 struct ParseTreeNode 
 {
     std::string value;
-    std::vector<std::shared_ptr<ParseTreeNode>> children; // ,      
+    std::vector<ParseTreeNode*> children; //    ParseTree
 
     ParseTreeNode(const std::string& val) : value(val) {}
 };
 
-//  
-class SyntaxAnalyzer
+//    :     ,    reset()
+class ParseTree
 {
 public:
-    SyntaxAnalyzer(LexicalAnalyzer& lexer, const std::string& outputFilename)
-        : lexer(lexer), outputFilename(outputFilename), currentTokenIndex(0) 
+    ParseTreeNode* make(const std::string& value)
     {
-        tokens = lexer.getTokens(); //    
-        previousToken = { TokenType::UNKNOWN, "" }; 
+        if (used < nodes.size())
+        {
+            ParseTreeNode& node = nodes[used++];
+            node.value = value;
+            node.children.clear();
+            return &node;
+        }
+        nodes.emplace_back(value); // deque     
+        ++used;
+        return &nodes.back();
     }
 
-    void parse() 
+    void reset()
+    {
+        used = 0;
+    }
+
+private:
+    std::deque<ParseTreeNode> nodes;
+    size_t used = 0;
+};
+
+//      : [begin, end)
+struct FunctionRange
+{
+    size_t begin;
+    size_t end;
+};
+
+//   
+class FunctionParser
+{
+public:
+    FunctionParser(TokenList tokens, FunctionRange range, ParseTree& tree)
+        : tokens(tokens), tree(tree), currentTokenIndex(range.begin), endIndex(range.end)
+    {
+        //        -    
+        previousToken = range.begin > 0 ? &tokens[range.begin - 1].first : &unknownToken(); 
+    }
+
+    //   ,    error   nullptr
+    ParseTreeNode* parse(Diagnostic& error)
     {
         try 
         {
-            root = parseFunction();
-            
-            outputParseTree(root, 0); 
+            return parseFunction();
         }
         catch (const std::runtime_error& e) 
         {
             std::string sim = "\'";
-            std::cerr << " : " 
-                << "|  " + std::to_string(currentLine()) + " | " << e.what()
-                << "  " + sim + previousToken.value << sim << '\n';
+            error.line = currentLine();
+            error.message = " : "
+                + std::string("|  ") + std::to_string(error.line) + " | " + e.what()
+                + "  " + sim + previousToken->value + sim;
+            return nullptr;
         }
     }
 
 private:
-    LexicalAnalyzer& lexer;
-    std::string outputFilename;
-    std::vector<std::pair<Token, int>> tokens; 
+    TokenList tokens; 
+    ParseTree& tree;
     size_t currentTokenIndex;  
-    std::shared_ptr<ParseTreeNode> root; 
-    Token previousToken; 
+    size_t endIndex;
+    const Token* previousToken; //   ,    
     bool findReturn = false;
 
-    bool lBrace = false;
-    bool rBrace = false;
+    static const Token& unknownToken()
+    {
+        static const Token unknown = { TokenType::UNKNOWN, "" };
+        return unknown;
+    }
 
    
-    Token currentToken() 
+    const Token& currentToken() 
     {
-        if (currentTokenIndex < tokens.size()) 
+        if (currentTokenIndex < endIndex) 
         {
             return tokens[currentTokenIndex].first;
         }
-        return { TokenType::UNKNOWN, "" }; //  UNKNOWN    
+        return unknownToken(); //  UNKNOWN    
     }
 
     int currentLine()
     {
-        return tokens[currentTokenIndex].second;
+        if (currentTokenIndex < endIndex)
+        {
+            return tokens[currentTokenIndex].second;
+        }
+        return endIndex > 0 ? tokens[endIndex - 1].second : 1; //   -   
     }
 
 
     
     void nextToken()
     {
-        if (currentTokenIndex < tokens.size())
+        if (currentTokenIndex < endIndex)
         {
-            previousToken = currentToken(); 
+            previousToken = &currentToken(); 
             ++currentTokenIndex;
         }
     }
@@ -87,9 +135,9 @@ private:
 
 
     // 
-    std::shared_ptr<ParseTreeNode> parseFunction()
+    ParseTreeNode* parseFunction()
     {
-        auto node = std::make_shared<ParseTreeNode>("Function");
+        auto node = tree.make("Function");
 
         
 
@@ -99,7 +147,7 @@ private:
         {
             throw std::runtime_error("  (int  float) "  );
         }
-        node->children.push_back(std::make_shared<ParseTreeNode>(currentToken().value));
+        node->children.push_back(tree.make(currentToken().value));
         nextToken(); // TYPE
 
 
@@ -108,12 +156,12 @@ private:
         {
             throw std::runtime_error("   "  );
         }
-        node->children.push_back(std::make_shared<ParseTreeNode>(currentToken().value));
+        node->children.push_back(tree.make(currentToken().value));
         nextToken(); // FunctionName
 
 
         
-        if (currentToken().type != TokenType::LPAREN && previousToken.type == TokenType::ID)
+        if (currentToken().type != TokenType::LPAREN && previousToken->type == TokenType::ID)
         {
             throw std::runtime_error(" '(' "  );
         }
@@ -127,7 +175,7 @@ private:
         }
         nextToken(); // ')'
   
-        if (currentToken().type != TokenType::LBRACE && previousToken.type == TokenType::RPAREN) 
+        if (currentToken().type != TokenType::LBRACE && previousToken->type == TokenType::RPAREN) 
         {
             throw std::runtime_error(" '{' "  );
         }
@@ -149,9 +197,9 @@ private:
         return node;
     }
 
-    std::shared_ptr<ParseTreeNode> parseDescriptions() 
+    ParseTreeNode* parseDescriptions() 
     {
-        auto node = std::make_shared<ParseTreeNode>("Descriptions");
+        auto node = tree.make("Descriptions");
 
         while (currentToken().type != TokenType::RBRACE)
         { //    
@@ -162,7 +210,7 @@ private:
     }
 
     //  Descr
-    std::shared_ptr<ParseTreeNode> parseDescr()
+    ParseTreeNode* parseDescr()
     {
 
         
@@ -172,7 +220,7 @@ private:
             findReturn = true;
            
         }
-        auto node = std::make_shared<ParseTreeNode>("Descr");
+        auto node = tree.make("Descr");
         
        
         if (currentToken().type != TokenType::TYPE_INT && currentToken().type != TokenType::TYPE_FLOAT &&
@@ -185,7 +233,7 @@ private:
             
              else throw std::runtime_error("  (int  float) " );
         }
-        node->children.push_back(std::make_shared<ParseTreeNode>(currentToken().value));
+        node->children.push_back(tree.make(currentToken().value));
         nextToken(); // TYPE
 
         //   
@@ -272,15 +320,15 @@ private:
         return node;
     }
 
-    std::shared_ptr<ParseTreeNode> parseSimpleExpr() {
-        auto node = std::make_shared<ParseTreeNode>("SimpleExpr");
+    ParseTreeNode* parseSimpleExpr() {
+        auto node = tree.make("SimpleExpr");
 
 
 
         if (currentToken().type == TokenType::ITOF)
 
         {
-            node->children.push_back(std::make_shared<ParseTreeNode>(currentToken().value));
+            node->children.push_back(tree.make(currentToken().value));
             nextToken();
 
 
@@ -308,7 +356,7 @@ private:
         else if (currentToken().type == TokenType::FTOI)
         {
             
-            node->children.push_back(std::make_shared<ParseTreeNode>(currentToken().value));
+            node->children.push_back(tree.make(currentToken().value));
             nextToken();
 
 
@@ -342,14 +390,14 @@ private:
 
 
     //  VarList
-    std::shared_ptr<ParseTreeNode> parseVarList() 
+    ParseTreeNode* parseVarList() 
     {
-        auto node = std::make_shared<ParseTreeNode>("VarList");
-        if (currentToken().type != TokenType::ID && previousToken.type != TokenType::RETURN) 
+        auto node = tree.make("VarList");
+        if (currentToken().type != TokenType::ID && previousToken->type != TokenType::RETURN) 
         {
             throw std::runtime_error("   "  );
         }
-        node->children.push_back(std::make_shared<ParseTreeNode>(currentToken().value));
+        node->children.push_back(tree.make(currentToken().value));
         nextToken(); // ID
 
         while (currentToken().type == TokenType::COMMA) 
@@ -359,7 +407,7 @@ private:
             {
                 throw std::runtime_error("   "   );
             }
-            node->children.push_back(std::make_shared<ParseTreeNode>(currentToken().value));
+            node->children.push_back(tree.make(currentToken().value));
             nextToken(); // ID
         }
 
@@ -367,9 +415,252 @@ private:
 
        
     }
+};
+
+//  
+class SyntaxAnalyzer
+{
+public:
+    SyntaxAnalyzer(LexicalAnalyzer& lexer, const std::string& outputFilename)
+        : lexer(lexer), outputFilename(outputFilename)
+    {
+    }
+
+    ~SyntaxAnalyzer()
+    {
+        {
+            std::lock_guard<std::mutex> lock(poolMutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread& t : pool)
+        {
+            t.join();
+        }
+    }
+
+    //    (nullptr -   std::cerr)
+    void setDiagnostics(Diagnostics* value)
+    {
+        diagnostics = value;
+    }
+
+    //     (0 -   )
+    void setThreadCount(size_t value)
+    {
+        threadCount = value;
+    }
+
+    //      
+    void parse() 
+    {
+        analyze();
+
+        if (root)
+        {
+            outputParseTree(root);
+        }
+    }
+
+    //  -  .   ,
+    //        .
+    //      ,  -  Program   ,
+    // ,  ,  -  .        .
+    void analyze()
+    {
+        tokens = lexer.getTokens(); //    
+        splitFunctions();
+        parseFunctions();
+
+        programTree.reset();
+        root = nullptr;
+        ParseTreeNode* program = countFunctions() > 1 ? programTree.make("Program") : nullptr;
+        for (size_t i = 0; i < ranges.size(); ++i)
+        {
+            if (!errors[i].message.empty())
+            {
+                if (diagnostics)
+                {
+                    Diagnostic& d = diagnostics->add(errors[i].line);
+                    d.message = errors[i].message;
+                }
+                else
+                {
+                    std::cerr << errors[i].message << '\n';
+                }
+            }
+            else if (program)
+            {
+                program->children.push_back(functionRoots[i]);
+            }
+            else
+            {
+                root = functionRoots[i]; //  
+            }
+        }
+        if (program && !program->children.empty())
+        {
+            root = program;
+        }
+    }
+
+    //    (nullptr,      )
+    const ParseTreeNode* getRoot() const
+    {
+        return root;
+    }
+
+private:
+    LexicalAnalyzer& lexer;
+    std::string outputFilename;
+    TokenList tokens; 
+    ParseTreeNode* root = nullptr; 
+    Diagnostics* diagnostics = nullptr;
+
+    std::vector<FunctionRange> ranges; //      
+    std::vector<ParseTreeNode*> functionRoots;
+    std::vector<Diagnostic> errors; //   -  
+    std::vector<ParseTree> workerTrees; //     
+    ParseTree programTree; //  Program
+    size_t threadCount = 0;
+
+    //          :
+    //  0 - ,     
+    std::vector<std::thread> pool;
+    std::mutex poolMutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    size_t generation = 0;
+    size_t activeWorkers = 0;
+    size_t pending = 0; //        
+    bool stopping = false;
+
+    //  :       .
+    //      ,     
+    //           
+    void splitFunctions()
+    {
+        ranges.clear();
+        size_t start = 0;
+        int depth = 0;
+        for (size_t i = 0; i < tokens.size(); ++i)
+        {
+            TokenType type = tokens[i].first.type;
+            if (depth == 0 && start < i && (type == TokenType::TYPE_INT || type == TokenType::TYPE_FLOAT))
+            {
+                ranges.push_back({ start, i });
+                start = i;
+            }
+
+            if (type == TokenType::LBRACE)
+            {
+                ++depth;
+            }
+            else if (type == TokenType::RBRACE && --depth <= 0) //  '}'   
+            {
+                ranges.push_back({ start, i + 1 });
+                start = i + 1;
+                depth = 0;
+            }
+        }
+        if (start < tokens.size() || ranges.empty())
+        {
+            ranges.push_back({ start, tokens.size() }); //     
+        }
+    }
+
+    //  ,   :   
+    //         
+    size_t countFunctions() const
+    {
+        size_t count = 0;
+        for (const FunctionRange& range : ranges)
+        {
+            if (range.begin < range.end)
+            {
+                TokenType type = tokens[range.begin].first.type;
+                if (type == TokenType::TYPE_INT || type == TokenType::TYPE_FLOAT) ++count;
+            }
+        }
+        return count;
+    }
+
+    void parseFunctions()
+    {
+        functionRoots.assign(ranges.size(), nullptr);
+        if (errors.size() < ranges.size()) errors.resize(ranges.size()); //  ,     
+        for (size_t i = 0; i < ranges.size(); ++i)
+        {
+            errors[i].message.clear();
+        }
+
+        //       ,    -   FUNCTIONS_PER_THREAD 
+        const size_t FUNCTIONS_PER_THREAD = 16;
+        size_t workers = threadCount ? threadCount : std::thread::hardware_concurrency();
+        workers = std::min(workers, ranges.size() / FUNCTIONS_PER_THREAD);
+        if (workers == 0) workers = 1;
+        if (workerTrees.size() < workers) workerTrees.resize(workers);
+
+        if (workers == 1)
+        {
+            parseBlock(0, 1);
+            return;
+        }
+
+        while (pool.size() + 1 < workers)
+        {
+            pool.emplace_back(&SyntaxAnalyzer::workerLoop, this, pool.size() + 1, generation);
+        }
+        {
+            std::lock_guard<std::mutex> lock(poolMutex);
+            activeWorkers = workers;
+            pending = workers - 1;
+            ++generation;
+        }
+        wake.notify_all();
+
+        parseBlock(0, workers);
+
+        std::unique_lock<std::mutex> lock(poolMutex);
+        done.wait(lock, [this] { return pending == 0; });
+    }
+
+    //  worker  workers     .   
+    //   ,           
+    //      
+    void parseBlock(size_t worker, size_t workers)
+    {
+        ParseTree& tree = workerTrees[worker];
+        tree.reset();
+        size_t begin = ranges.size() * worker / workers;
+        size_t end = ranges.size() * (worker + 1) / workers;
+        for (size_t i = begin; i < end; ++i)
+        {
+            FunctionParser parser(tokens, ranges[i], tree);
+            functionRoots[i] = parser.parse(errors[i]);
+        }
+    }
+
+    void workerLoop(size_t worker, size_t seenGeneration)
+    {
+        std::unique_lock<std::mutex> lock(poolMutex);
+        for (;;)
+        {
+            wake.wait(lock, [&] { return stopping || generation != seenGeneration; });
+            if (stopping) return;
+            seenGeneration = generation;
+            if (worker >= activeWorkers) continue; //      
+
+            size_t workers = activeWorkers;
+            lock.unlock();
+            parseBlock(worker, workers);
+            lock.lock();
+            if (--pending == 0) done.notify_one();
+        }
+    }
 
     //    
-    void outputParseTree(const std::shared_ptr<ParseTreeNode>& node, int depth) 
+    void outputParseTree(const ParseTreeNode* node) 
     {
         std::ofstream outFile(outputFilename, std::ios::app);
         if (!outFile.is_open())
@@ -377,11 +668,16 @@ private:
             std::cerr << ":      ." << std::endl;
             return;
         }
-        outFile << std::string(depth * 2, ' ') << node->value << std::endl; // 
-        for (const auto& child : node->children) 
+        outputParseTree(outFile, node, 0);
+        outFile.close();
+    }
+
+    void outputParseTree(std::ostream& outFile, const ParseTreeNode* node, int depth) 
+    {
+        outFile << std::string(depth * 2, ' ') << node->value << '\n'; // 
+        for (const ParseTreeNode* child : node->children) 
         {
-            outputParseTree(child, depth + 1); //  
+            outputParseTree(outFile, child, depth + 1); //  
         }
-        outFile.close();
     }
 };
\ No newline at end of file
@@ -21,3 +21,16 @@ struct Token
    
 
 };
+
+
+//      (   )
+struct TokenList
+{
+    const std::pair<Token, int>* items = nullptr;
+    size_t count = 0;
+
+    size_t size() const { return count; }
+    const std::pair<Token, int>& operator[](size_t i) const { return items[i]; }
+    const std::pair<Token, int>* begin() const { return items; }
+    const std::pair<Token, int>* end() const { return items + count; }
+};
\ No newline at end of file
@@ -0,0 +1,146 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "UnicodeLetters.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define UTF8_USE_SSE2
+#endif
+
+//   ASCII   .    setlocale
+enum CharClass : unsigned char
+{
+    CHAR_OTHER, CHAR_SPACE, CHAR_LETTER, CHAR_DIGIT
+};
+
+const unsigned char ASCII_CLASSES[128] =
+{
+    CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER,
+    CHAR_OTHER, CHAR_SPACE, CHAR_SPACE, CHAR_SPACE, CHAR_SPACE, CHAR_SPACE, CHAR_OTHER, CHAR_OTHER,
+    CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER,
+    CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER,
+    CHAR_SPACE, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER,
+    CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER,
+    CHAR_DIGIT, CHAR_DIGIT, CHAR_DIGIT, CHAR_DIGIT, CHAR_DIGIT, CHAR_DIGIT, CHAR_DIGIT, CHAR_DIGIT,
+    CHAR_DIGIT, CHAR_DIGIT, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER,
+    CHAR_OTHER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER,
+    CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER,
+    CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER,
+    CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER,
+    CHAR_OTHER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER,
+    CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER,
+    CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_LETTER,
+    CHAR_LETTER, CHAR_LETTER, CHAR_LETTER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER, CHAR_OTHER,
+};
+
+inline CharClass asciiClass(unsigned char c)
+{
+    return static_cast<CharClass>(ASCII_CLASSES[c]);
+}
+
+//      ASCII  (   UNICODE_LETTERS)
+inline bool isUnicodeLetter(uint32_t codePoint)
+{
+    size_t low = 0;
+    size_t high = UNICODE_LETTER_RANGES;
+    while (low < high)
+    {
+        size_t middle = (low + high) / 2;
+        if (codePoint > UNICODE_LETTERS[middle].last)
+        {
+            low = middle + 1;
+        }
+        else if (codePoint < UNICODE_LETTERS[middle].first)
+        {
+            high = middle;
+        }
+        else
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//    UTF-8   p.
+//        codePoint; 0 -  
+// (  ,  ,  , , > U+10FFFF)
+inline int decodeUtf8(const unsigned char* p, size_t available, uint32_t& codePoint)
+{
+    unsigned char c = p[0];
+    if (c < 0x80)
+    {
+        codePoint = c;
+        return 1;
+    }
+
+    int length;
+    uint32_t value;
+    uint32_t minimum;
+    if ((c & 0xE0) == 0xC0) { length = 2; value = c & 0x1F; minimum = 0x80; }
+    else if ((c & 0xF0) == 0xE0) { length = 3; value = c & 0x0F; minimum = 0x800; }
+    else if ((c & 0xF8) == 0xF0) { length = 4; value = c & 0x07; minimum = 0x10000; }
+    else return 0;
+
+    if (available < static_cast<size_t>(length)) return 0;
+    for (int k = 1; k < length; ++k)
+    {
+        if ((p[k] & 0xC0) != 0x80) return 0;
+        value = (value << 6) | (p[k] & 0x3F);
+    }
+    if (value < minimum || value > 0x10FFFF || (value >= 0xD800 && value <= 0xDFFF)) return 0;
+
+    codePoint = value;
+    return length;
+}
+
+//    32    p    
+inline bool isAsciiBlock(const unsigned char* p)
+{
+#ifdef UTF8_USE_SSE2
+    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16));
+    return _mm_movemask_epi8(_mm_or_si128(a, b)) == 0;
+#else
+    uint64_t words[4];
+    std::memcpy(words, p, sizeof(words));
+    return ((words[0] | words[1] | words[2] | words[3]) & 0x8080808080808080ULL) == 0;
+#endif
+}
+
+//     UTF-8.   32      ,
+//    .       size
+inline size_t validateUtf8(const unsigned char* data, size_t size)
+{
+    size_t i = 0;
+    while (i < size)
+    {
+        size_t blockEnd = size;
+        if (size - i >= 32)
+        {
+            if (isAsciiBlock(data + i))
+            {
+                i += 32;
+                continue;
+            }
+            blockEnd = i + 32;
+        }
+
+        //       -      
+        while (i < blockEnd)
+        {
+            if (data[i] < 0x80)
+            {
+                ++i;
+                continue;
+            }
+            uint32_t codePoint;
+            int length = decodeUtf8(data + i, size - i, codePoint);
+            if (length == 0) return i;
+            i += length;
+        }
+    }
+    return size;
+}
\ No newline at end of file